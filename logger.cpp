@@ -6,12 +6,17 @@
 
 #include "logger.h"
 
+#include <cstring>
 #include <ctime>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <chrono>
-#include <functional>
-#include <iomanip>
+#include <mutex>
+#include <unordered_map>
+
+#if !defined(_WIN32)
+#include <unistd.h> // For isatty(). Used to keep color codes away from redirected output.
+#endif
 
 namespace DV {
 
@@ -20,57 +25,321 @@ namespace DV {
     // ----------------------------------------------------------------------------------------------------
 
     /**
-     * @brief Unix/Linux specific unicode values for printing colored text to a terminal.
+     * @brief Unix/Linux specific escape code values for printing colored text to a terminal.
+     * @details These are constexpr string_views inside an anonymous namespace: their lengths are known at compile
+     * time (so appending one never runs strlen), and each constant has exactly one internal-linkage definition
+     * here rather than a per-translation-unit static copy.
      */
+    namespace {
     namespace TerminalColor {
-        [[maybe_unused]] static const char* const black      = "\u001B[30m";
-        [[maybe_unused]] static const char* const red        = "\u001B[31m";
-        [[maybe_unused]] static const char* const green      = "\u001B[32m";
-        [[maybe_unused]] static const char* const yellow     = "\u001B[33m";
-        [[maybe_unused]] static const char* const blue       = "\u001B[34m";
-        [[maybe_unused]] static const char* const magenta    = "\u001B[35m";
-        [[maybe_unused]] static const char* const cyan       = "\u001B[36m";
-        [[maybe_unused]] static const char* const white      = "\u001B[37m";
-        [[maybe_unused]] static const char* const reset      = "\u001B[0m";
-        [[maybe_unused]] static const char* const bgBlack    = "\u001B[40m";
-        [[maybe_unused]] static const char* const bgRed      = "\u001B[41m";
-        [[maybe_unused]] static const char* const bgGreen    = "\u001B[42m";
-        [[maybe_unused]] static const char* const bgYellow   = "\u001B[43m";
-        [[maybe_unused]] static const char* const bgBlue     = "\u001B[44m";
-        [[maybe_unused]] static const char* const bgMagenta  = "\u001B[45m";
-        [[maybe_unused]] static const char* const bgCyan     = "\u001B[46m";
-        [[maybe_unused]] static const char* const bgWhite    = "\u001B[47m";
+        [[maybe_unused]] constexpr std::string_view black      = "\u001B[30m";
+        [[maybe_unused]] constexpr std::string_view red        = "\u001B[31m";
+        [[maybe_unused]] constexpr std::string_view green      = "\u001B[32m";
+        [[maybe_unused]] constexpr std::string_view yellow     = "\u001B[33m";
+        [[maybe_unused]] constexpr std::string_view blue       = "\u001B[34m";
+        [[maybe_unused]] constexpr std::string_view magenta    = "\u001B[35m";
+        [[maybe_unused]] constexpr std::string_view cyan       = "\u001B[36m";
+        [[maybe_unused]] constexpr std::string_view white      = "\u001B[37m";
+        [[maybe_unused]] constexpr std::string_view reset      = "\u001B[0m";
+        [[maybe_unused]] constexpr std::string_view bgBlack    = "\u001B[40m";
+        [[maybe_unused]] constexpr std::string_view bgRed      = "\u001B[41m";
+        [[maybe_unused]] constexpr std::string_view bgGreen    = "\u001B[42m";
+        [[maybe_unused]] constexpr std::string_view bgYellow   = "\u001B[43m";
+        [[maybe_unused]] constexpr std::string_view bgBlue     = "\u001B[44m";
+        [[maybe_unused]] constexpr std::string_view bgMagenta  = "\u001B[45m";
+        [[maybe_unused]] constexpr std::string_view bgCyan     = "\u001B[46m";
+        [[maybe_unused]] constexpr std::string_view bgWhite    = "\u001B[47m";
+    }
+
+    /**
+     * @brief The level tags, pre-concatenated with their color escape codes at compile time.
+     * @details Adjacent string literal concatenation glues each color-on code, tag text, and reset code into one
+     * compile-time literal, so stamping a tag into a header is a single copy of one contiguous string. The codes
+     * mirror the TerminalColor constants above — keep the two in sync. plainLevelTags is the colorless variant for
+     * output that is not heading to a terminal. Both tables are indexed by Logger::LogLevel.
+     */
+    constexpr std::string_view coloredLevelTags[6] = {
+            "\u001B[34m" "INFO"  "\u001B[0m",                 // Blue
+            "\u001B[33m" "WARN"  "\u001B[0m",                 // Yellow
+            "\u001B[31m" "ERROR" "\u001B[0m",                 // Red
+            "\u001B[30m" "\u001B[41m" "FATAL" "\u001B[0m",    // Black on Red
+            "\u001B[32m" "DEBUG" "\u001B[0m",                 // Green
+            "\u001B[0m"  "TRACE" "\u001B[0m",                 // Default terminal color.
+    };
+    constexpr std::string_view plainLevelTags[6] = { "INFO", "WARN", "ERROR", "FATAL", "DEBUG", "TRACE" };
+
+    // Whether color escape codes make sense for a stream. Targeting std::cout is necessary but not sufficient —
+    // stdout may be redirected into a file or a pipe, where escape codes are just garbage bytes. The answer
+    // can't change after a stream is added, so it is checked exactly once per stream.
+    bool streamWantsColor(std::ostream& os)
+    {
+        bool liveTerminal = os.rdbuf() == std::cout.rdbuf();
+#if !defined(_WIN32)
+        liveTerminal = liveTerminal && isatty(STDOUT_FILENO);
+#endif
+        return liveTerminal;
+    }
+
+    // The write mutex shared by every logger targeting the same stream buffer. Keyed by the buffer rather than
+    // the ostream because that is the identity that matters — std::cout and a user-constructed ostream wrapping
+    // cout's buffer are the same output device. The registry itself is only touched when a stream is added, so
+    // its guard mutex is never on the logging path, and unordered_map's stable node addresses let each logger
+    // keep a plain pointer to its entry afterward.
+    std::mutex& sharedStreamMutex(std::streambuf* buffer)
+    {
+        static std::mutex registryGuard;
+        static std::unordered_map<std::streambuf*, std::mutex> registry;
+        std::lock_guard<std::mutex> hold(registryGuard);
+        return registry[buffer];
     }
+    }
+
+
+    // ----------------------------------------------------------------------------------------------------
+    // Timestamp formatting helpers.
+    // ----------------------------------------------------------------------------------------------------
+
+    namespace {
+        // Lookup table of every two digit value from "00" through "99", two characters per entry. Indexing with
+        // 2*n gives the first character of the printed form of n.
+        constexpr char twoDigits[] =
+                "00010203040506070809"
+                "10111213141516171819"
+                "20212223242526272829"
+                "30313233343536373839"
+                "40414243444546474849"
+                "50515253545556575859"
+                "60616263646566676869"
+                "70717273747576777879"
+                "80818283848586878889"
+                "90919293949596979899";
+
+        /**
+         * @brief Converts a count of days since the Unix epoch into a calendar date.
+         * @details This is Howard Hinnant's "civil_from_days" algorithm — completely branchless, just a handful of
+         * integer operations. It exists here because std::localtime is both non-reentrant and, on common libc
+         * implementations, takes a timezone-database lock on every call, which made it a contention hotspot once
+         * many threads were logging at once.
+         * @param days
+         * — Days since 1970-01-01.
+         * @param year @param month @param day
+         * — Receive the resulting calendar date.
+         */
+        void civilFromDays(long long days, int& year, int& month, int& day)
+        {
+            days += 719468;
+            const long long era = (days >= 0 ? days : days - 146096) / 146097;
+            const auto doe = static_cast<unsigned>(days - era*146097);                      // [0, 146096]
+            const unsigned yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;           // [0, 399]
+            const long long y = static_cast<long long>(yoe) + era*400;
+            const unsigned doy = doe - (365*yoe + yoe/4 - yoe/100);                         // [0, 365]
+            const unsigned mp = (5*doy + 2)/153;                                            // [0, 11]
+            day = static_cast<int>(doy - (153*mp + 2)/5 + 1);                               // [1, 31]
+            month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);                            // [1, 12]
+            year = static_cast<int>(y + (month <= 2));
+        }
+
+        /**
+         * @brief Writes a calendar time as "YYYY-MM-DD HH:MM:SS" (19 characters plus a null terminator).
+         * @details The layout of the date and time in a log header is completely fixed, so there is no need for
+         * std::strftime to walk a format string and consult the locale for every entry. This writes each field
+         * directly using the two digit lookup table above, which is just a handful of table reads and stores.
+         * @param out
+         * — Destination buffer. Must have room for at least 20 characters.
+         * @param year @param month @param day @param hour @param minute @param second
+         * — The calendar time to print.
+         */
+        void formatFixedTimestamp(char* out, int year, int month, int day, int hour, int minute, int second)
+        {
+            std::memcpy(out,      &twoDigits[2*(year/100)], 2);
+            std::memcpy(out + 2,  &twoDigits[2*(year%100)], 2);
+            out[4] = '-';
+            std::memcpy(out + 5,  &twoDigits[2*month], 2);
+            out[7] = '-';
+            std::memcpy(out + 8,  &twoDigits[2*day], 2);
+            out[10] = ' ';
+            std::memcpy(out + 11, &twoDigits[2*hour], 2);
+            out[13] = ':';
+            std::memcpy(out + 14, &twoDigits[2*minute], 2);
+            out[16] = ':';
+            std::memcpy(out + 17, &twoDigits[2*second], 2);
+            out[19] = '\0';
+        }
+
+        /**
+         * @brief Writes a sub-second nanosecond count as exactly nine zero-padded digits plus a null terminator.
+         * @details The value is always in [0, 999999999], so the print is fully unrolled through the two digit
+         * lookup table — no locale-aware integer streaming and no padding manipulators needed.
+         * @param out
+         * — Destination buffer. Must have room for at least 10 characters.
+         * @param nanoseconds
+         * — The sub-second value to print.
+         */
+        void formatFixedNanoseconds(char* out, long nanoseconds)
+        {
+            std::memcpy(out,     &twoDigits[2*(nanoseconds/10000000)], 2);
+            std::memcpy(out + 2, &twoDigits[2*((nanoseconds/100000)%100)], 2);
+            std::memcpy(out + 4, &twoDigits[2*((nanoseconds/1000)%100)], 2);
+            std::memcpy(out + 6, &twoDigits[2*((nanoseconds/10)%100)], 2);
+            out[8] = static_cast<char>('0' + nanoseconds%10);
+            out[9] = '\0';
+        }
+
+        /**
+         * @brief Renders a raw clock reading as "[TZONE YYYY-MM-DD HH:MM:SS:NANOSECONDS] ".
+         * @details Many log entries land within the same second, so the formatted text is cached and only rebuilt
+         * when the second actually rolls over. localtime()/strftime() run only when the *minute* changes, and
+         * only to refresh the timezone name and UTC offset (which shift with DST at most once an hour). The date
+         * and time digits themselves come from civilFromDays() and plain integer math — important because
+         * localtime() grabs a timezone-database lock inside common libc implementations. Each Logger has its own
+         * writer thread and every one of them calls this, so the caches are thread_local — each writer keeps its
+         * own copy and no locking is needed.
+         * @param out
+         * — Destination buffer. Must have room for at least 48 characters.
+         * @param seconds
+         * — Whole seconds since the Unix epoch, as captured by the logging call.
+         * @param nanoseconds
+         * — The sub-second remainder of the same clock reading.
+         * @return The number of characters written. (The output is not null terminated.)
+         */
+        size_t formatTimestampPrefix(char* out, std::time_t seconds, long nanoseconds)
+        {
+            // "TZONE YYYY-MM-DD HH:MM:SS\0" — the timezone name varies in length, the rest is fixed at 19 chars.
+            thread_local std::time_t cachedSec = -1;
+            thread_local char timeStr[32] = {0};
+            thread_local size_t zoneLen = 0;
+            thread_local long utcOffset = 0;
+            thread_local std::time_t cachedMinute = -1;
+            if (seconds != cachedSec) {
+                if (seconds/60 != cachedMinute) {
+                    std::tm timeNow = {};
+#if defined(_WIN32)
+                    localtime_s(&timeNow, &seconds);
+#else
+                    localtime_r(&seconds, &timeNow);
+#endif
+                    zoneLen = std::strftime(timeStr, sizeof(timeStr) - 20, "%Z ", &timeNow);
+                    // Parse the "+hhmm"/"-hhmm" offset form into seconds east of UTC. %z is allowed to produce
+                    // nothing at all when the zone is unknown (some C runtimes do exactly that), so only parse
+                    // when the sign character confirms the expected form; otherwise treat the offset as zero.
+                    char offsetText[8] = {0};
+                    std::strftime(offsetText, sizeof(offsetText), "%z", &timeNow);
+                    if (offsetText[0] == '+' || offsetText[0] == '-') {
+                        long hours = (offsetText[1] - '0')*10 + (offsetText[2] - '0');
+                        long minutes = (offsetText[3] - '0')*10 + (offsetText[4] - '0');
+                        utcOffset = (hours*60 + minutes)*60 * (offsetText[0] == '-' ? -1 : 1);
+                    }
+                    else {
+                        utcOffset = 0;
+                    }
+                    cachedMinute = seconds/60;
+                }
+                std::time_t localSec = seconds + utcOffset;
+                long long days = localSec/86400 - (localSec % 86400 < 0 ? 1 : 0); // Floor, even before the epoch.
+                auto secondOfDay = static_cast<int>(localSec - days*86400);
+                int year, month, day;
+                civilFromDays(days, year, month, day);
+                formatFixedTimestamp(timeStr + zoneLen, year, month, day,
+                        secondOfDay/3600, (secondOfDay/60)%60, secondOfDay%60);
+                cachedSec = seconds;
+            }
 
-    // Simple stream manipulators to change the terminal output colors.
-    std::ostream& infoColor(std::ostream& os) { os << TerminalColor::blue; return os; }
-    std::ostream& warnColor(std::ostream& os) { os << TerminalColor::yellow; return os; }
-    std::ostream& errorColor(std::ostream& os) { os << TerminalColor::red; return os; }
-    std::ostream& fatalColor(std::ostream& os) { os << TerminalColor::black << TerminalColor::bgRed; return os; }
-    std::ostream& debugColor(std::ostream& os) { os << TerminalColor::green; return os; }
-    std::ostream& traceColor(std::ostream& os) { os << TerminalColor::reset; return os; }
-    std::ostream& resetColor(std::ostream& os) { os << TerminalColor::reset; return os; }
+            // Stitch the bracketed prefix together. The nanosecond field goes through the same two-digit table
+            // as the rest of the timestamp, so the whole prefix is table reads, memcpy, and single stores.
+            size_t len = 0;
+            out[len++] = '[';
+            std::memcpy(out + len, timeStr, zoneLen + 19);
+            len += zoneLen + 19;
+            out[len++] = ':';
+            formatFixedNanoseconds(out + len, nanoseconds);
+            len += 9;
+            out[len++] = ']';
+            out[len++] = ' ';
+            return len;
+        }
+    }
 
     // ----------------------------------------------------------------------------------------------------
     // Logger Public Interface Implementation
     // ----------------------------------------------------------------------------------------------------
 
     Logger::Logger(const char* name, std::ostream& os)
-            :_name(name)
     {
-        _outputColorText = os.rdbuf() == std::cout.rdbuf();
-        _streams.push_back(std::ref(os));
+        this->appendStream(os); // No lock needed here: the writer thread doesn't exist yet.
+        this->buildHeaderPrefixes(name);
+
+        // Prepare the ring. Each cell's sequence number starts at its own position — the "free, waiting for a
+        // producer on lap zero" state of the handoff protocol. Entry text up to the typical length lives inline
+        // in the cells themselves, so the ring runs allocation-free except for rare oversized entries.
+        for (size_t i = 0; i < queueCapacity; ++i) {
+            _entryQueue[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        _writerThread = std::thread(&Logger::writerLoop, this);
     }
 
-    Logger::~Logger() = default;
+    Logger::~Logger()
+    {
+        // Ask the writer thread to drain whatever is still queued and stop, then wait for it.
+        _shuttingDown.store(true, std::memory_order_release);
+        if (_writerThread.joinable()) {
+            _writerThread.join();
+        }
+    }
+
+    void Logger::flush()
+    {
+        // Wait for the writer thread to finish everything queued so far, then flush the streams themselves.
+        // With the lock-free ring there is no condition variable to sleep on, so this politely spins instead —
+        // acceptable because flush() is a rare, caller-initiated durability point, never a hot path.
+        while (_dequeuePos.load(std::memory_order_acquire) != _enqueuePos.load(std::memory_order_acquire)
+                || _writerBusy.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        this->forEachStream([](StreamEntry& entry) {
+            std::lock_guard<std::mutex> hold(*entry.writeMutex);
+            entry.stream->flush();
+        });
+    }
 
     void Logger::addSplit(std::ostream& os)
     {
-        // FIXME: The implementation of color output assumes that only one stream will be sent data, and that it matches
-        //        std::cout. Once any additional streams get added they will also get the color codes sent to them and
-        //        they may not know how to handle them.
-        _outputColorText = false; // Disable color output for split streams. Not elegant, but easy.
-        _streams.push_back(std::ref(os));
+        // The lock fences off the writer thread, which walks the stream list on every sweep. Adding a split to
+        // a live logger is an advertised use, so the list can genuinely change mid-run.
+        std::lock_guard<std::mutex> hold(_streamListMutex);
+        this->appendStream(os);
+    }
+
+    /**
+     * @brief The shared guts of stream registration. Callers hold the stream list lock (see the header).
+     */
+    void Logger::appendStream(std::ostream& os)
+    {
+        // Every stream carries its own color capability, so tee'ing a file no longer costs the terminal its
+        // colors (and the file never sees escape codes it can't render).
+        const StreamEntry entry = { &os, streamWantsColor(os), &sharedStreamMutex(os.rdbuf()) };
+        if (_streamCount < maxStreams) {
+            _streams[_streamCount] = entry;
+        }
+        else {
+            // Past the inline slots. See the note in the header documentation — this is not the expected use,
+            // but nothing gets dropped.
+            _overflowStreams.push_back(entry);
+        }
+        ++_streamCount;
+    }
+
+    /**
+     * @brief Tees output to several streams in one call.
+     * @details The only work beyond repeated addSplit() calls is reserving the heap spillover in one step when
+     * the batch runs past the inline slots, instead of growing it stream by stream.
+     */
+    void Logger::addSplits(std::initializer_list<std::reference_wrapper<std::ostream>> streams)
+    {
+        std::lock_guard<std::mutex> hold(_streamListMutex);
+        const size_t total = _streamCount + streams.size();
+        if (total > maxStreams) { _overflowStreams.reserve(total - maxStreams); }
+        for (const std::reference_wrapper<std::ostream>& stream : streams) { this->appendStream(stream.get()); }
     }
 
     // ----------------------------------------------------------------------------------------------------
@@ -78,68 +347,279 @@ namespace DV {
     // ----------------------------------------------------------------------------------------------------
 
     /**
-     * @brief Assembles the timestamp and log level tags at the start of a logged message.
-     * @param level
-     * — The kind of logging being done. (info, warning, error, etc.) This effects text coloring if logging is being
-     * done to a terminal.
+     * @brief Builds both flavors of the per-level "[name:TAG]\t" header prefixes from the logger name.
+     * @details The tag text itself (color codes included) comes from the compile-time tables above; this glues
+     * the logger name in around it, once per level and flavor, so that logging calls never re-assemble the
+     * header piecemeal and the name itself never needs to be kept. Construction only.
+     * @param name
+     * — The name of the logger, exactly as passed to the constructor.
      */
-    void Logger::buildHeader(LogLevel level)
+    void Logger::buildHeaderPrefixes(const char* name)
     {
-        // Get the current time.
-        // By default, the time is represented in nanoseconds, but adding in the duration_cast helps future-proof
-        // the code a bit.
-        auto curTimeNanosecondPrecision = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        auto buildPrefix = [name](std::string_view tag) {
+            std::string prefix;
+            prefix += '[';
+            prefix += name;
+            prefix += ':';
+            prefix += tag;
+            prefix += "]\t";
+            return prefix;
+        };
+        for (size_t i = 0; i < _plainHeaderPrefixes.size(); ++i) {
+            _coloredHeaderPrefixes[i] = buildPrefix(coloredLevelTags[i]);
+            _plainHeaderPrefixes[i] = buildPrefix(plainLevelTags[i]);
+        }
+    }
+
+    /**
+     * @brief Queues the content of the buffer for the background writer thread and clears the buffer.
+     * @details The timestamp for the entry is captured here as a raw clock reading — rendering it to text happens
+     * over on the writer thread along with the actual stream I/O (see writerLoop()), so callers never wait on
+     * either. Queueing is lock-free: a producer claims a cell with one compare-and-swap on _enqueuePos, fills it,
+     * and publishes it by bumping the cell's sequence number, so concurrent logging threads never serialize on a
+     * mutex. Under sustained overload low-severity entries are shed at a fill watermark (and the drops counted
+     * and reported) so producers don't spin on a full ring; warn and above always queue, waiting for a free
+     * cell if they must.
+     */
+    void Logger::write(LogLevel logLevel, MessageBuffer& buffer, std::ostream& bufferStream) {
+        // Backpressure: when producers have the ring nearly full, shed low-severity entries rather than letting
+        // every logging thread spin on a full ring. The fill estimate is approximate — both positions keep
+        // moving — which is fine, since the watermark only needs to trip somewhere near two-thirds. The counts
+        // are reported by the writer thread once it catches up. Warn, error, and fatal are never shed, and
+        // setLossless(true) turns shedding off entirely (every call then waits for queue space instead).
+        const bool lowSeverity = logLevel == LogLevel::info || logLevel == LogLevel::debug
+                || logLevel == LogLevel::trace;
+        if (lowSeverity && !_lossless.load(std::memory_order_relaxed)) {
+            const size_t fill = _enqueuePos.load(std::memory_order_relaxed)
+                    - _dequeuePos.load(std::memory_order_relaxed);
+            if (fill >= queuePressureThreshold) {
+                _droppedCounts[static_cast<size_t>(logLevel)].fetch_add(1, std::memory_order_relaxed);
+                buffer.clear();
+                bufferStream.clear();
+                return;
+            }
+        }
+
+        // Capture the current time as whole seconds plus leftover nanoseconds.
+        // clock_gettime() hands over both halves in one call — typically vDSO-accelerated, so not even a real
+        // syscall — with no division needed afterwards to split a nanosecond count apart. std::chrono remains as
+        // the fallback for platforms without it. This raw reading is all the logging call pays for its timestamp.
+        std::time_t curTimeSecondPrecision;
+        long curTimeNanoseconds;
+#if defined(_WIN32)
+        auto sinceEpochNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
                 std::chrono::system_clock::now().time_since_epoch()).count();
+        curTimeSecondPrecision = sinceEpochNs/1000000000; // Deliberate integer rounding.
+        curTimeNanoseconds = static_cast<long>(sinceEpochNs - curTimeSecondPrecision*1000000000LL);
+#else
+        // DV_LOGGER_COARSE_TIMESTAMPS (see the note in logger.h) swaps in the kernel's tick-granularity clock:
+        // a plain memory read with no counter scaling, at the cost of millisecond-ish timestamp resolution.
+#if defined(DV_LOGGER_COARSE_TIMESTAMPS) && defined(CLOCK_REALTIME_COARSE)
+        constexpr clockid_t entryClock = CLOCK_REALTIME_COARSE;
+#else
+        constexpr clockid_t entryClock = CLOCK_REALTIME;
+#endif
+        timespec timeNowExact = {};
+        clock_gettime(entryClock, &timeNowExact);
+        curTimeSecondPrecision = timeNowExact.tv_sec;
+        curTimeNanoseconds = timeNowExact.tv_nsec;
+#endif
 
-        // Format the time as human readable.
-        // "%F %T" --> "%Y-%m-%d %H:%M:%S" --> "TZONE 2019-08-23 13:42:58\0" (26 chars)
-        char timeStr[26] = {0};
-        std::time_t curTimeSecondPrecision = curTimeNanosecondPrecision/1000000000; // Deliberate integer rounding.
-        std::strftime(timeStr, sizeof(timeStr), "%Z %F %T", std::localtime(&curTimeSecondPrecision));
-
-        // Finally, print the time stamp.
-        _buffer << '['
-            << timeStr
-            << ':'
-            << std::setw(9) << std::right << std::setfill('0')
-            << (curTimeNanosecondPrecision - curTimeSecondPrecision*1000000000)
-            << ']';
-        _buffer << ' ';
-
-        // Append logger name and level.
-        _buffer << '[';
-        _buffer << _name << ':';
-        if (_outputColorText) {
-            switch (level) {                                                                // Default Colors
-                case LogLevel::info:  _buffer << infoColor  << "INFO"  << resetColor; break;// Blue
-                case LogLevel::warn:  _buffer << warnColor  << "WARN"  << resetColor; break;// Yellow
-                case LogLevel::error: _buffer << errorColor << "ERROR" << resetColor; break;// Red
-                case LogLevel::fatal: _buffer << fatalColor << "FATAL" << resetColor; break;// Black on Red
-                case LogLevel::debug: _buffer << debugColor << "DEBUG" << resetColor; break;// Green
-                case LogLevel::trace: _buffer << traceColor << "TRACE" << resetColor; break;// Default terminal color.
-                default: break;
+        // Claim a cell. A cell is free for position pos exactly when its sequence number equals pos; winning the
+        // compare-and-swap on _enqueuePos makes the cell ours alone until we publish it.
+        QueueCell* cell;
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_entryQueue[pos % queueCapacity];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            if (seq == pos) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                // Lost the race for this cell — pos was reloaded by the failed exchange, so just go again.
+            }
+            else if (seq < pos) {
+                // A full lap behind: the ring is full. Yield until the writer recycles this cell rather than
+                // silently dropping the entry.
+                std::this_thread::yield();
+                pos = _enqueuePos.load(std::memory_order_relaxed);
             }
-        } else {
-            switch (level) {
-            case LogLevel::info:  _buffer << "INFO"; break;
-            case LogLevel::warn:  _buffer << "WARN"; break;
-            case LogLevel::error: _buffer << "ERROR"; break;
-            case LogLevel::fatal: _buffer << "FATAL"; break;
-            case LogLevel::debug: _buffer << "DEBUG"; break;
-            case LogLevel::trace: _buffer << "TRACE"; break;
-            default: break;
+            else {
+                // Another producer claimed this position first. Move along to the current head.
+                pos = _enqueuePos.load(std::memory_order_relaxed);
             }
         }
-        _buffer << "]\t";
+
+        cell->entry.seconds = curTimeSecondPrecision;
+        cell->entry.nanoseconds = curTimeNanoseconds;
+        cell->entry.level = logLevel;
+        // The newline terminator is stored as part of the entry, so the writer thread can push the whole
+        // thing at each stream in one contiguous write instead of a body write plus a separate put. Text that
+        // fits the cell's inline array — almost everything — is a straight memcpy into the ring; anything
+        // longer goes through the cell's heap spill string instead.
+        cell->entry.length = buffer.size() + 1;
+        if (cell->entry.length <= typicalEntryLength) {
+            std::memcpy(cell->entry.text, buffer.data(), buffer.size());
+            cell->entry.text[buffer.size()] = '\n';
+        }
+        else {
+            cell->entry.overflow.assign(buffer.data(), buffer.size());
+            cell->entry.overflow.push_back('\n');
+        }
+        // Publish: the release store is what makes everything written above visible to the writer thread.
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        buffer.clear();
+        bufferStream.clear(); // Reset any error state too. (Set if an over-long entry was truncated.)
     }
 
     /**
-     * @brief Copies the content of the buffer to the output stream(s) and clears the buffer.
+     * @brief The background writer thread. Renders timestamps and moves queued entries into the output stream(s).
+     * @details Entries are taken from the ring in order and coalesced: each sweep drains everything published
+     * (up to writerBatchBytes) into one staging buffer, renders the timestamps on the way — each entry carries
+     * its moment of logging as a raw clock reading — and then hands each stream the whole batch in a single
+     * write. A burst of a thousand back-to-back log calls thus becomes a handful of large writes per stream
+     * instead of a thousand small ones. The streams are flushed whenever the ring goes quiet, and at least every
+     * ten milliseconds during sustained bursts, so buffered text is never more than a blink away from durable
+     * while the flush syscalls stay off the per-entry cost. When the ring stays empty the loop backs off gently
+     * — a handful of yields, then short naps — since without a condition variable there is nothing to sleep on;
+     * the naps bound the idle wakeup rate while keeping worst-case latency small.
      */
-    void Logger::write() {
-        for (auto & streamItem : _streams) {
-            streamItem.get() << _buffer.str() << std::endl;
+    void Logger::writerLoop() {
+        // The staging buffers are reused for every sweep, so each settles at a steady-state capacity and stops
+        // allocating. Two flavors exist because streams differ on color: a batch with color-coded headers for
+        // live terminals and a plain one for everything else. Only the flavors actually needed get built.
+        std::string stagingColored; // The batch for color-capable streams.
+        std::string stagingPlain;   // The batch for everything else.
+        stagingColored.reserve(writerBatchBytes + MessageBuffer::capacity); // Room for one entry past the limit.
+        stagingPlain.reserve(writerBatchBytes + MessageBuffer::capacity);
+
+        constexpr auto flushInterval = std::chrono::milliseconds(10);
+        auto lastFlush = std::chrono::steady_clock::now();
+        bool unflushedOutput = false;   // Whether anything has been written since the last flush.
+        size_t pos = 0;     // The next position to read. Only this thread advances it (single consumer).
+        int idleSpins = 0;  // How many times in a row the ring has come up empty.
+        while (true) {
+            // Which batch flavors this sweep needs depends on the current stream list.
+            bool needColored = false;
+            bool needPlain = false;
+            this->forEachStream([&](StreamEntry& entry) { (entry.color ? needColored : needPlain) = true; });
+
+            // Sweep: gather every published entry (up to the batch limit) into the staging buffer(s).
+            stagingColored.clear();
+            stagingPlain.clear();
+            while (stagingColored.size() < writerBatchBytes && stagingPlain.size() < writerBatchBytes) {
+                QueueCell& cell = _entryQueue[pos % queueCapacity];
+                if (cell.sequence.load(std::memory_order_acquire) != pos + 1) { break; }
+                _writerBusy.store(true, std::memory_order_relaxed);
+
+                // The cell is exclusively ours until its sequence number is bumped, so the timestamp is
+                // rendered and the payload appended straight out of the ring — no intermediate copy.
+                char prefix[48];
+                const size_t prefixLen = formatTimestampPrefix(prefix, cell.entry.seconds, cell.entry.nanoseconds);
+                const size_t levelIndex = static_cast<size_t>(cell.entry.level);
+                auto appendTo = [&](std::string& staging, const std::string& headerPrefix) {
+                    staging.append(prefix, prefixLen);
+                    staging += headerPrefix;
+                    if (cell.entry.length <= typicalEntryLength) { staging.append(cell.entry.text, cell.entry.length); }
+                    else { staging.append(cell.entry.overflow); }
+                };
+                if (needColored) { appendTo(stagingColored, _coloredHeaderPrefixes[levelIndex]); }
+                if (needPlain) { appendTo(stagingPlain, _plainHeaderPrefixes[levelIndex]); }
+
+                // Recycle the cell for the next lap around the ring, then advance. The _writerBusy store above
+                // is made visible by the release ordering here, which is what lets flush() trust what it reads.
+                cell.sequence.store(pos + queueCapacity, std::memory_order_release);
+                ++pos;
+                _dequeuePos.store(pos, std::memory_order_release);
+            }
+
+            // Surface any entries shed under queue pressure (see write()). The report is synthesized here on
+            // the writer thread — it never competes with producers for ring space — and rides along in the same
+            // batch as regular output, stamped as a warning since losing entries is worth noticing.
+            for (size_t levelIndex = 0; levelIndex < _droppedCounts.size(); ++levelIndex) {
+                const size_t dropped = _droppedCounts[levelIndex].exchange(0, std::memory_order_relaxed);
+                if (dropped == 0) { continue; }
+#if defined(_WIN32)
+                const auto sinceEpochNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count();
+                const std::time_t reportSeconds = sinceEpochNs / 1000000000;
+                const long reportNanoseconds = static_cast<long>(sinceEpochNs - reportSeconds * 1000000000LL);
+#else
+                timespec reportTime = {};
+                clock_gettime(CLOCK_REALTIME, &reportTime);
+                const std::time_t reportSeconds = reportTime.tv_sec;
+                const long reportNanoseconds = reportTime.tv_nsec;
+#endif
+                char prefix[48];
+                const size_t prefixLen = formatTimestampPrefix(prefix, reportSeconds, reportNanoseconds);
+                std::string report = "Dropped ";
+                report += std::to_string(dropped);
+                report += ' ';
+                report += plainLevelTags[levelIndex];
+                report += " entries under queue pressure.\n";
+                const size_t warnIndex = static_cast<size_t>(LogLevel::warn);
+                if (needColored) {
+                    stagingColored.append(prefix, prefixLen);
+                    stagingColored += _coloredHeaderPrefixes[warnIndex];
+                    stagingColored += report;
+                }
+                if (needPlain) {
+                    stagingPlain.append(prefix, prefixLen);
+                    stagingPlain += _plainHeaderPrefixes[warnIndex];
+                    stagingPlain += report;
+                }
+            }
+
+            if (!stagingColored.empty() || !stagingPlain.empty()) {
+                idleSpins = 0;
+                // Go straight at each stream's buffer. ostream::write constructs a sentry and does locale and
+                // error-state bookkeeping per call; sputn is the raw byte-copy underneath all of that, which is
+                // all a batch of fully assembled entries needs.
+                this->forEachStream([&](StreamEntry& entry) {
+                    const std::string& batch = entry.color ? stagingColored : stagingPlain;
+                    std::lock_guard<std::mutex> hold(*entry.writeMutex);
+                    entry.stream->rdbuf()->sputn(batch.data(), static_cast<std::streamsize>(batch.size()));
+                });
+                unflushedOutput = true;
+                _writerBusy.store(false, std::memory_order_release); // flush() may be waiting on this batch.
+
+                // Mid-burst durability: don't let buffered text age past the flush interval just because the
+                // producers never pause.
+                const auto now = std::chrono::steady_clock::now();
+                if (now - lastFlush >= flushInterval) {
+                    this->forEachStream([](StreamEntry& entry) {
+                        std::lock_guard<std::mutex> hold(*entry.writeMutex);
+                        entry.stream->flush();
+                    });
+                    lastFlush = now;
+                    unflushedOutput = false;
+                }
+                continue; // Go straight back around — more entries may have landed during the writes.
+            }
+
+            // The ring is empty. Flush once on the way into an idle stretch so everything logged so far becomes
+            // durable while there is nothing better to do.
+            if (unflushedOutput) {
+                this->forEachStream([](StreamEntry& entry) {
+                    std::lock_guard<std::mutex> hold(*entry.writeMutex);
+                    entry.stream->flush();
+                });
+                lastFlush = std::chrono::steady_clock::now();
+                unflushedOutput = false;
+            }
+            // Exit only once shutdown has been requested *and* no producer has claimed the read position — a
+            // claimed-but-unpublished cell still has to be written.
+            if (_shuttingDown.load(std::memory_order_acquire)
+                    && _enqueuePos.load(std::memory_order_acquire) == pos) {
+                break;
+            }
+            if (++idleSpins < 64) { std::this_thread::yield(); }
+            else { std::this_thread::sleep_for(std::chrono::microseconds(100)); }
         }
-        _buffer.str("");
+
+        // Shutting down. Everything queued has been written, so give the streams one last flush.
+        this->forEachStream([](StreamEntry& entry) {
+            std::lock_guard<std::mutex> hold(*entry.writeMutex);
+            entry.stream->flush();
+        });
     }
 }
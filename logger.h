@@ -7,12 +7,56 @@
 #ifndef DV_LOGGER_H
 #define DV_LOGGER_H
 
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
-#include <sstream>
-#include <string>
 #include <mutex>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+/**
+ * @name Compile-Time Log Level Selection
+ * @brief Defines for choosing, at build time, which logging levels get compiled into the program at all.
+ * @details Define DV_LOGGER_COMPILE_LEVEL to one of the DV_LOGGER_LEVEL_* values below (typically on the compiler
+ * command line) to discard every logging call above that verbosity. Calls to discarded levels compile down to
+ * nothing — no argument formatting, no locking, no output — so debug() and trace() calls can be left in place in
+ * release builds at zero cost. The ordering matches the note on Logger's LogLevel enum: setting the level to
+ * DV_LOGGER_LEVEL_FATAL keeps all the standard levels and removes only debug and trace.
+ */
+///@{
+#define DV_LOGGER_LEVEL_INFO  0
+#define DV_LOGGER_LEVEL_WARN  1
+#define DV_LOGGER_LEVEL_ERROR 2
+#define DV_LOGGER_LEVEL_FATAL 3
+#define DV_LOGGER_LEVEL_DEBUG 4
+#define DV_LOGGER_LEVEL_TRACE 5
+
+#ifndef DV_LOGGER_COMPILE_LEVEL
+#define DV_LOGGER_COMPILE_LEVEL DV_LOGGER_LEVEL_TRACE
+#endif
+///@}
+
+/**
+ * @name Coarse Timestamp Capture
+ * @brief Define DV_LOGGER_COARSE_TIMESTAMPS (on the compiler command line) to capture entry timestamps with the
+ * kernel's coarse clock where one is available.
+ * @details The default clock read is already cheap — typically a vDSO call, not a real syscall — but it still
+ * scales the hardware counter on every logging call. The coarse clock is a plain memory read of the kernel's
+ * last tick, trading timestamp resolution (roughly one to four milliseconds; the nanosecond field then mostly
+ * ticks over in jumps) for the cheapest capture possible. Leave it off unless profiling shows timestamp capture
+ * itself crowding extremely hot logging paths. Has no effect on platforms without CLOCK_REALTIME_COARSE.
+ */
+
 /**
  * @brief "DV" is short for David Vitez.
  */
@@ -31,6 +75,35 @@ namespace DV {
      * >  [TZONE YYYY-MM-DD HH:MM:SS:NS] [Terminal Log:INFO] Simple test: 5 3.14 a b c
      * @endcode
      */
+    /**
+     * @brief A fixed-capacity character buffer for assembling log entries.
+     * @details std::stringstream backs its storage with a heap allocated, geometrically growing buffer and every
+     * insertion travels through locale-aware formatting machinery. Log entries are short and short-lived, so this
+     * buffer instead holds a fixed internal array and exposes it through the std::streambuf interface. That keeps
+     * every type printable via the usual stream output overloads working unchanged while removing all per-entry
+     * heap allocation.
+     * @note Entries longer than the capacity are truncated. At 4KB that is far beyond any sane log line.
+     */
+    class MessageBuffer : public std::streambuf {
+    public:
+        /// @brief How many characters the buffer can hold. Anything beyond this is truncated.
+        static constexpr size_t capacity = 4096;
+
+        MessageBuffer() { this->setp(_data, _data + capacity); }
+
+        /// @brief Read access to the assembled text. (Not null terminated. Pair with size().)
+        [[nodiscard]] const char* data() const { return this->pbase(); }
+
+        /// @brief The number of characters currently held.
+        [[nodiscard]] size_t size() const { return static_cast<size_t>(this->pptr() - this->pbase()); }
+
+        /// @brief Empties the buffer so the next entry can be assembled. The storage itself is reused as-is.
+        void clear() { this->setp(_data, _data + capacity); }
+
+    private:
+        char _data[capacity];
+    };
+
     /**
      * @brief A simple logging tool.
      * @details This is a very simple logging tool built around std::ostream, which means it can write log entries to
@@ -40,10 +113,41 @@ namespace DV {
      * the logging functions in any order you wish. Every argument must be printable via the usual stream output
      * overloads (which makes custom print formats easy to create) and each argument will automatically be separated
      * with spaces as they are printed.
+     * @details Writing to the output stream(s) happens asynchronously. Each logging call assembles its entry,
+     * captures the current time as a raw clock reading, and hands both to a background writer thread, so callers
+     * never wait on timestamp rendering, stream I/O, or disk I/O — only on message assembly. The timestamp still
+     * reflects the moment of the logging call, and entries are still written out in the order the calls completed.
+     * The writer drains everything still queued before the logger destructs, and flush() waits for the queue to
+     * empty.
      */
     class Logger {
     public:
 
+        /**
+         * @brief Specifies the type of log entry being created.
+         * @details INFO is a general purpose level. Good for progress reports and normal operations.
+         * @details WARN is for anything that could be a problem but doesn't necessarily mean the program is unusable.
+         * It can also be a general alert, or mark the beginning of risky operations.
+         * @details ERROR is for definite problems, such as when a needed resource fails to load, or a function throws
+         * an exception.
+         * @details FATAL is for anything that causes the entire program to terminate. Using this log level does not
+         * shutdown the program like it does in some other loggers. It is simply for reporting. Shutting down the
+         * software is the software's problem, not the logger's.
+         * @details DEBUG is for any messages that expose detailed under-the-hood types of information, such as pointer
+         * addresses, variables names, etc.
+         * @details TRACE is for reporting function calls and program flow. This does not actually monitor the call
+         * stack or in any way track functions or call depth. Like all other logging levels it is simply for organizing
+         * log entries.
+         * @note 1. Levels can be compiled out entirely with DV_LOGGER_COMPILE_LEVEL (see the defines at the top of
+         * this file), or filtered at run time with setLevel(). The order specified here is what makes both work:
+         * for example, setting either level to "fatal" allows for logging of all types of messages except debug
+         * and trace.
+         * @note 2. In the future this tool may be expanded so that trace maintains a breadcrumb like listing of
+         * functions. This has not been looked into very closely yet as it was firmly decided that this would not be a
+         * v1.0 feature, but it is being considered for the future.
+         */
+        enum class LogLevel { info, warn, error, fatal, debug, trace };
+
         // ----------------------------------------------------------------------------------------------------
         // Constructors, destructors, and other setup functions.
         // ----------------------------------------------------------------------------------------------------
@@ -66,13 +170,66 @@ namespace DV {
         /**
          * @brief Tees output.
          * @details Adds an additional reference to an output stream for log entries to be sent to. This duplicates the
-         * logger's output to multiple locations. There is no limit to the number of new output streams that can be
-         * registered using this function, though in practice, if duplicating output is needed at all, it is not
-         * usually to more than one or two new streams.
+         * logger's output to multiple locations. A logger keeps up to four streams in fast inline storage (the one
+         * given at construction plus three splits) — in practice, if duplicating output is needed at all, it is not
+         * usually to more than one or two new streams. Splits beyond that are still accepted and simply spill to
+         * slower heap storage. Each stream decides its own color handling: a live terminal keeps color-coded
+         * level tags while file streams tee'd alongside it receive plain text.
          * @param os
          * — The new additional output stream to send log entries to.
          */
         void addSplit(std::ostream& os);
+
+        /**
+         * @brief Tees output to several streams at once.
+         * @details Equivalent to calling addSplit() once per stream, in order, with one difference: any heap
+         * spill storage needed for streams past the inline slots is reserved in a single allocation up front.
+         * Plain stream references work directly at the call site — addSplits({fileA, fileB, fileC}) — since
+         * they wrap implicitly.
+         * @param streams
+         * — The additional output streams to send log entries to.
+         */
+        void addSplits(std::initializer_list<std::reference_wrapper<std::ostream>> streams);
+
+        /**
+         * @brief Sets the most verbose kind of message that will still be logged.
+         * @details This is the runtime counterpart to DV_LOGGER_COMPILE_LEVEL: calls at levels past the setting
+         * return immediately after one relaxed atomic read, before any message assembly happens. Unlike the
+         * compile-time filter the arguments are still evaluated, so prefer the compile-time filter when a level
+         * should never exist in a build at all. Defaults to LogLevel::trace — everything logs. Safe to call from
+         * any thread at any time.
+         * @param level
+         * — The new cutoff. For example LogLevel::fatal keeps info through fatal and filters debug and trace.
+         */
+        void setLevel(LogLevel level) { _runtimeLevel.store(level, std::memory_order_relaxed); }
+
+        /// @brief The current runtime level cutoff, as set by setLevel().
+        [[nodiscard]] LogLevel level() const { return _runtimeLevel.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Whether messages of the given kind currently make it into the log.
+         * @details Useful at call sites that would do real work just to build a message: checking first skips the
+         * argument evaluation that a filtered logging call would still pay for.
+         * @param level
+         * — The kind of message in question.
+         */
+        [[nodiscard]] bool isEnabled(LogLevel level) const
+        { return static_cast<int>(level) <= static_cast<int>(_runtimeLevel.load(std::memory_order_relaxed)); }
+
+        /**
+         * @brief Chooses whether low-severity entries may be shed when the queue falls behind.
+         * @details By default, once the entry queue runs about two-thirds full, info/debug/trace calls are
+         * counted and dropped instead of queued — the logger sheds chatter rather than stalling every producer
+         * thread — and the writer reports the counts in-band once it catches up. (Warn, error, and fatal always
+         * queue.) Pass true to forbid shedding entirely: every call then waits for queue space, trading
+         * producer throughput under overload for a complete log. Safe to call from any thread at any time.
+         * @param lossless
+         * — True to keep every entry at the cost of blocking producers whenever the queue fills.
+         */
+        void setLossless(bool lossless) { _lossless.store(lossless, std::memory_order_relaxed); }
+
+        /// @brief Whether every entry is kept (true) or low-severity entries may be shed under pressure (false).
+        [[nodiscard]] bool lossless() const { return _lossless.load(std::memory_order_relaxed); }
         ///@}
 
         /**
@@ -91,7 +248,7 @@ namespace DV {
         Logger& operator=(const Logger& rhs) = delete; // Copy Assignment Operator
         ///@}
 
-        ~Logger(); // Default.
+        ~Logger(); // Stops the background writer thread, draining any still-queued entries first.
 
         // ----------------------------------------------------------------------------------------------------
         // Public logging functions.
@@ -127,76 +284,280 @@ namespace DV {
          * will be accepted.
          */
         ///@{
-        template<typename... Message> void debug (Message... msg) { this->assemble(LogLevel::debug, msg...); }
-        template<typename... Message> void error (Message... msg) { this->assemble(LogLevel::error, msg...); }
-        template<typename... Message> void fatal (Message... msg) { this->assemble(LogLevel::fatal, msg...); }
-        template<typename... Message> void info  (Message... msg) { this->assemble(LogLevel::info,  msg...); }
-        template<typename... Message> void trace (Message... msg) { this->assemble(LogLevel::trace, msg...); }
-        template<typename... Message> void warn  (Message... msg) { this->assemble(LogLevel::warn,  msg...); }
+        template<typename... Message> void debug (Message&&... msg)
+        {
+            if constexpr (DV_LOGGER_LEVEL_DEBUG <= DV_LOGGER_COMPILE_LEVEL) {
+                this->log(LogLevel::debug, std::forward<Message>(msg)...);
+            }
+        }
+
+        template<typename... Message> void error (Message&&... msg)
+        {
+            if constexpr (DV_LOGGER_LEVEL_ERROR <= DV_LOGGER_COMPILE_LEVEL) {
+                this->log(LogLevel::error, std::forward<Message>(msg)...);
+            }
+        }
+
+        template<typename... Message> void fatal (Message&&... msg)
+        {
+            if constexpr (DV_LOGGER_LEVEL_FATAL <= DV_LOGGER_COMPILE_LEVEL) {
+                this->log(LogLevel::fatal, std::forward<Message>(msg)...);
+            }
+        }
+
+        template<typename... Message> void info  (Message&&... msg)
+        {
+            if constexpr (DV_LOGGER_LEVEL_INFO <= DV_LOGGER_COMPILE_LEVEL) {
+                this->log(LogLevel::info, std::forward<Message>(msg)...);
+            }
+        }
+
+        template<typename... Message> void trace (Message&&... msg)
+        {
+            if constexpr (DV_LOGGER_LEVEL_TRACE <= DV_LOGGER_COMPILE_LEVEL) {
+                this->log(LogLevel::trace, std::forward<Message>(msg)...);
+            }
+        }
+
+        template<typename... Message> void warn  (Message&&... msg)
+        {
+            if constexpr (DV_LOGGER_LEVEL_WARN <= DV_LOGGER_COMPILE_LEVEL) {
+                this->log(LogLevel::warn, std::forward<Message>(msg)...);
+            }
+        }
         ///@}
 
+        /**
+         * @brief Logs one entry at a level chosen at run time.
+         * @details This is the single funnel the named functions above forward into, exposed publicly for call
+         * sites where the level is a variable rather than spelled out — retrying something at error instead of
+         * warn, say, or looping over levels in a test. Runtime level filtering applies as usual. Note that the
+         * compile-time filter cannot see through a variable: entries discarded by DV_LOGGER_COMPILE_LEVEL are
+         * only removed at the named functions, so prefer those whenever the level is fixed.
+         * @param level
+         * — The kind of log entry to create.
+         * @param msg
+         * — The message parts, exactly as the named logging functions take them.
+         */
+        template<typename... Message> void log(LogLevel level, Message&&... msg)
+        {
+            if (this->isEnabled(level)) { this->assemble(level, std::forward<Message>(msg)...); }
+        }
+
+        /**
+         * @brief Flushes every output stream the logger writes to.
+         * @details Log entries end with a plain newline rather than a forced flush, which keeps high-rate logging
+         * from paying a stream round trip per entry. The background writer flushes the streams on its own
+         * whenever the queue goes quiet, and periodically during sustained bursts, so text never sits buffered
+         * for long — but call this whenever durability matters at a specific moment, such as just before an
+         * expected shutdown.
+         */
+        void flush();
+
     private:
         // TODO: Revisit pImpl. Figure out what can and can't be hidden while preserving the variadic templates.
-        const char* _name;          // Name of the logger.
         // std::ostream& _out;         // Output stream
-        std::vector<std::reference_wrapper<std::ostream>> _streams;    // All output streams (usually 1, maybe 2).
-        std::stringstream _buffer;  // Buffer for assembling the finished message to output.
-        std::mutex _writeMutex;     // For protecting buffering and write operations from threads.
-        bool _outputColorText;      // For stopping color codes from being used when not printing to std::cout.
+        // Output streams live in a small fixed array rather than a heap-backed vector. The common case is one
+        // stream (maybe two when tee'd), so the whole list stays on one cache line right inside the logger.
+        // Anything past the inline capacity spills to a heap vector that stays empty in normal use. Each stream
+        // carries its own color capability flag, decided once when the stream is added, so a tee'd terminal can
+        // keep its colors while file streams alongside it get plain text. Each also carries a pointer to the
+        // write mutex shared by every logger targeting the same underlying stream buffer — two loggers tee'd
+        // into the same file (or both on std::cout) take the same lock and can't interleave mid-entry, while
+        // loggers on distinct streams never contend.
+        struct StreamEntry {
+            std::ostream* stream = nullptr;     // The stream itself.
+            bool color = false;                 // Whether this stream receives the color-coded header flavor.
+            std::mutex* writeMutex = nullptr;   // Held around writes and flushes. Shared per stream buffer.
+        };
+        static constexpr size_t maxStreams = 4;             // Inline slots: the primary stream plus three splits.
+        std::array<StreamEntry, maxStreams> _streams = {};  // Inline stream storage (usually 1 in use, maybe 2).
+        size_t _streamCount = 0;                            // Total number of streams, inline and spilled.
+        std::vector<StreamEntry> _overflowStreams;          // Splits past the inline capacity. Rarely touched.
+        // Guards the three members above: addSplit() may be called on a live logger while the writer thread is
+        // iterating the list. Producers never touch the stream list, so this lock never sits on the logging path.
+        std::mutex _streamListMutex;
+        // Whether queue-pressure shedding is forbidden. (See setLossless().) Read per logging call, relaxed.
+        std::atomic<bool> _lossless{false};
+        // The runtime level filter. Calls at levels past this return before any assembly work. (See setLevel().)
+        std::atomic<LogLevel> _runtimeLevel{LogLevel::trace};
+        // The complete "[name:TAG]\t" header text for every level, in colored and plain flavors. Both sets are
+        // built exactly once during construction — the logger name is folded into them and kept nowhere else —
+        // and the writer thread stamps whichever flavor each stream's color flag calls for. Stamping a header
+        // is a single contiguous copy: no per-call piecing together of brackets, name, and tag.
+        std::array<std::string, 6> _coloredHeaderPrefixes;  // Indexed by LogLevel.
+        std::array<std::string, 6> _plainHeaderPrefixes;    // Indexed by LogLevel.
 
-        /**
-         * @brief Specifies the type of log entry being created.
-         * @details INFO is a general purpose level. Good for progress reports and normal operations.
-         * @details WARN is for anything that could be a problem but doesn't necessarily mean the program is unusable.
-         * It can also be a general alert, or mark the beginning of risky operations.
-         * @details ERROR is for definite problems, such as when a needed resource fails to load, or a function throws
-         * an exception.
-         * @details FATAL is for anything that causes the entire program to terminate. Using this log level does not
-         * shutdown the program like it does in some other loggers. It is simply for reporting. Shutting down the
-         * software is the software's problem, not the logger's.
-         * @details DEBUG is for any messages that expose detailed under-the-hood types of information, such as pointer
-         * addresses, variables names, etc.
-         * @details TRACE is for reporting function calls and program flow. This does not actually monitor the call
-         * stack or in any way track functions or call depth. Like all other logging levels it is simply for organizing
-         * log entries.
-         * @note 1. In the future this tool may be expanded so that logging of different levels can be turned off, but
-         * currently that is not the case. If that is ever implemented the order specified here could be important as,
-         * for example, setting the level to "fatal" would allow for logging of all types of messages except debug and
-         * trace.
-         * @note 2. In the future this tool may be expanded so that trace maintains a breadcrumb like listing of
-         * functions. This has not been looked into very closely yet as it was firmly decided that this would not be a
-         * v1.0 feature, but it is being considered for the future.
-         */
-        enum class LogLevel { info, warn, error, fatal, debug, trace };
+        // --- Asynchronous output machinery. ---
+        // Finished entries are handed to a background writer thread through a bounded lock-free ring (Dmitry
+        // Vyukov's MPMC queue, used here with a single consumer): any number of logging threads enqueue
+        // concurrently without ever taking a lock, and the writer thread drains in order. Each cell's sequence
+        // number says whose turn the cell is — equal to the cell's position while free for a producer, to
+        // position + 1 once an entry is published, and to position + capacity once the writer has recycled it
+        // for the next lap around the ring. See write() and writerLoop() for the two sides of the handoff.
+        static constexpr size_t queueCapacity = 1024;           // Entries the ring can hold before producers wait.
+        static constexpr size_t typicalEntryLength = 256;       // Inline payload bytes per ring cell. Log lines
+                                                                // rarely run longer, so the ring almost never
+                                                                // touches the heap.
+        static constexpr size_t writerBatchBytes = 64 * 1024;   // How many bytes the writer coalesces into one
+                                                                // stream write before starting another sweep.
+        // The ring fill level past which low-severity entries are shed instead of queued. Producers that outrun
+        // the writer otherwise end up spin-waiting on a full ring — burning whole cores to say "Loop iteration".
+        // Above this watermark info/debug/trace entries are counted and dropped (the writer reports the count
+        // once the pressure passes); warn, error, and fatal always queue, waiting for a free cell if they must.
+        // setLossless(true) disables shedding altogether for callers who need every entry.
+        static constexpr size_t queuePressureThreshold = (queueCapacity / 3) * 2;
+        // Each queued entry carries the moment it was logged as a raw clock reading rather than as text.
+        // Rendering a timestamp is by far the most expensive part of header assembly, so deferring it moves that
+        // cost off the logging call and onto the writer thread, which has cycles to spare between bursts.
+        // The message text itself — everything after the "[timestamp] [name:LEVEL]\t" header — lives in a fixed
+        // array right inside the cell for typical lengths, so producing an entry is a straight memcpy into the
+        // ring and consuming one reads fields and payload from adjacent memory with no pointer chase. Only
+        // entries too long for the inline array touch the heap, through a spill string the cell keeps around.
+        struct QueuedEntry {
+            std::time_t seconds = 0;            // Whole seconds since the Unix epoch, captured at the logging call.
+            long nanoseconds = 0;               // The sub-second remainder of the same clock reading.
+            LogLevel level = LogLevel::info;    // Which level logged the entry. Selects the header flavor text.
+            size_t length = 0;                  // Bytes of entry text, terminating newline included.
+            char text[typicalEntryLength];      // The text itself whenever it fits (the overwhelmingly common case).
+            std::string overflow;               // Spill storage for entries longer than the inline array.
+        };
+        struct QueueCell {
+            std::atomic<size_t> sequence{0};    // Turn counter for the handoff protocol described above.
+            QueuedEntry entry;                  // The payload.
+        };
+        std::array<QueueCell, queueCapacity> _entryQueue;   // Ring storage of entries awaiting output.
+        // The two positions only ever increase (a cell's index is its position % capacity). Each lives on its
+        // own cache line so producers bumping _enqueuePos never ping-pong the line the writer works from.
+        alignas(64) std::atomic<size_t> _enqueuePos{0};     // The next position a producer will claim.
+        alignas(64) std::atomic<size_t> _dequeuePos{0};     // The next position the writer will read.
+        std::atomic<bool> _writerBusy{false};   // True while the writer thread is mid-write. (Lets flush() wait.)
+        std::atomic<bool> _shuttingDown{false}; // Tells the writer thread to drain the ring and exit.
+        // How many entries of each level were shed under queue pressure since the writer last reported.
+        // Indexed by LogLevel; only the low-severity slots are ever incremented.
+        std::array<std::atomic<size_t>, 6> _droppedCounts = {};
+        std::thread _writerThread;              // The background writer. Runs writerLoop() for the logger's lifetime.
 
         template<typename... Message>
-        void assemble(LogLevel logLevel, Message... msg)
+        void assemble(LogLevel logLevel, Message&&... msg)
         {
-            _writeMutex.lock();
-            this->buildHeader(logLevel);    // Add a header to the output buffer.
-            this->assemble(msg...);         // Add all message parts (via 1 of 2 assembly helpers) to the buffer.
-            this->write();                  // Write the finished message buffer to the output stream.
-            _writeMutex.unlock();
+            // Every thread assembles entries in its own buffer, so no locking is needed here at all — the only
+            // synchronization point is handing the finished entry to the writer thread inside write(). The buffer
+            // (and its stream interface) is created once per thread and reused for every subsequent entry.
+            thread_local MessageBuffer buffer;
+            thread_local std::ostream bufferStream(&buffer);
+
+            // Append every message part in one left-to-right pass, separated with spaces. A fold expression does
+            // this without the per-argument recursion (and its tower of template instantiations) that peeling one
+            // part off per helper call used to cost. Each part goes through appendPart(), which picks the
+            // cheapest append path its type allows. An argument-free call (a bare header, sometimes useful as a
+            // marker line) skips all of it at compile time.
+            if constexpr (sizeof...(Message) > 0) {
+                bool firstPart = true;
+                auto appendWithSeparator = [&](const auto& part) {
+                    if (!firstPart) { bufferStream.put(' '); }
+                    firstPart = false;
+                    appendPart(bufferStream, part);
+                };
+                (appendWithSeparator(msg), ...);
+            }
+
+            this->write(logLevel, buffer, bufferStream); // Queue the finished message for the writer thread.
+        }
+
+        /**
+         * @brief Applies an action to every output stream — the inline slots first, then any heap spillover.
+         * @details Holds the stream list lock for the duration, so the list can't shift underneath the action
+         * while addSplit() runs on another thread.
+         */
+        template<typename Action>
+        void forEachStream(Action action) {
+            std::lock_guard<std::mutex> hold(_streamListMutex);
+            const size_t inlineCount = _streamCount < maxStreams ? _streamCount : maxStreams;
+            for (size_t i = 0; i < inlineCount; ++i) { action(_streams[i]); }
+            for (StreamEntry& entry : _overflowStreams) { action(entry); }
         }
 
-        // First message assembly helper for when there are two or more parts.
-        template<typename First, typename... Rest>
-        void assemble(First first, Rest... rest)
+        /**
+         * @brief Appends one message part to an assembly buffer.
+         * @details This is the dispatch point for per-type append paths. Overloads for specific types can write
+         * into the buffer directly; this generic version is the catch-all that routes everything else through
+         * the type's standard stream output overload, which is what keeps arbitrary user types printable.
+         * (Arithmetic types are carved out so they can't fall through to here — they have their own path
+         * below, and letting both match would make every numeric call ambiguous.)
+         */
+        template<typename Part, std::enable_if_t<!std::is_arithmetic_v<Part>, int> = 0>
+        static void appendPart(std::ostream& bufferStream, const Part& part) { bufferStream << part; }
+
+        /**
+         * @brief Append path for numbers — integers and floating point alike.
+         * @details Streaming a number runs it through the locale's num_put facet, which re-derives formatting
+         * decisions on every call. std::to_chars renders the same digits an order of magnitude faster, so
+         * numbers are converted on the stack and copied in as plain characters. Floating point comes out in
+         * shortest round-trip form, which matches what the default stream precision shows for typical values.
+         */
+        template<typename Number, std::enable_if_t<std::is_arithmetic_v<Number>, int> = 0>
+        static void appendPart(std::ostream& bufferStream, Number part)
         {
-            _buffer << first << ' ';
-            this->assemble(rest...);
+            char digits[48];    // Comfortably fits the longest long double rendering.
+            const auto result = std::to_chars(digits, digits + sizeof(digits), part);
+            bufferStream.write(digits, static_cast<std::streamsize>(result.ptr - digits));
         }
 
-        // Second message assembly helper for when there is only one part.
-        template<typename Message>
-        void assemble(Message msg) { _buffer << msg; }
+        /// @brief Append path for single characters, which are text rather than numbers despite being an
+        /// arithmetic type.
+        static void appendPart(std::ostream& bufferStream, char part) { bufferStream.put(part); }
 
-        // First part of message assembly. Adds a header to the message based on the given logging level.
-        void buildHeader(LogLevel);
+        /// @brief Append path for bools. std::to_chars has no bool form, so the default "1"/"0" rendering is
+        /// produced directly.
+        static void appendPart(std::ostream& bufferStream, bool part) { bufferStream.put(part ? '1' : '0'); }
 
-        // Output the fully assembled message to the output stream.
-        void write();
+        /**
+         * @brief Append path for character arrays — in practice, string literals.
+         * @details Streaming a literal with operator<< walks it with strlen first even though the length sat in
+         * the type all along. Here strnlen gets the array size as its bound: for a genuine literal the compiler
+         * folds the whole call down to the same N-1 compile-time constant, while a partially-filled character
+         * buffer still stops at its terminator instead of logging the uninitialized tail.
+         */
+        template<size_t N>
+        static void appendPart(std::ostream& bufferStream, const char (&literal)[N])
+        { bufferStream.write(literal, static_cast<std::streamsize>(strnlen(literal, N))); }
+
+        /// @brief Append path for string_views: the length is already carried, so no strlen and no stream
+        /// operator dispatch.
+        static void appendPart(std::ostream& bufferStream, std::string_view part)
+        { bufferStream.write(part.data(), static_cast<std::streamsize>(part.size())); }
+
+        // Appends one stream to the list. The caller must hold _streamListMutex (or be the constructor,
+        // which runs before the writer thread exists).
+        void appendStream(std::ostream& os);
+
+        // Builds both flavors of the per-level header prefixes from the logger name. Construction only — the
+        // name is not stored anywhere else. (The "[timestamp] [name:LEVEL]\t" header as a whole is rendered by
+        // the writer thread, which picks the flavor each stream's color flag calls for.)
+        void buildHeaderPrefixes(const char* name);
+
+        // Hand the fully assembled message over to the background writer thread, then reset the buffer.
+        void write(LogLevel logLevel, MessageBuffer& buffer, std::ostream& bufferStream);
+
+        // The body of the background writer thread. Drains queued entries into the output stream(s).
+        void writerLoop();
     };
 }
 
+// ----------------------------------------------------------------------------------------------------
+// Call-site gating macros.
+// ----------------------------------------------------------------------------------------------------
+// The logging functions already check the runtime level before doing any assembly work, but by then the
+// caller's arguments have been evaluated. That matters when an argument is itself expensive — a function
+// call, a string built just for the log line. These wrappers hoist the level check in front of argument
+// evaluation, so a filtered call costs one atomic load and nothing else. Plain log.info(...) calls remain
+// the right choice when the arguments are already at hand.
+#define DV_LOG_INFO(log, ...)  do { if ((log).isEnabled(DV::Logger::LogLevel::info))  { (log).info(__VA_ARGS__);  } } while (false)
+#define DV_LOG_WARN(log, ...)  do { if ((log).isEnabled(DV::Logger::LogLevel::warn))  { (log).warn(__VA_ARGS__);  } } while (false)
+#define DV_LOG_ERROR(log, ...) do { if ((log).isEnabled(DV::Logger::LogLevel::error)) { (log).error(__VA_ARGS__); } } while (false)
+#define DV_LOG_FATAL(log, ...) do { if ((log).isEnabled(DV::Logger::LogLevel::fatal)) { (log).fatal(__VA_ARGS__); } } while (false)
+#define DV_LOG_DEBUG(log, ...) do { if ((log).isEnabled(DV::Logger::LogLevel::debug)) { (log).debug(__VA_ARGS__); } } while (false)
+#define DV_LOG_TRACE(log, ...) do { if ((log).isEnabled(DV::Logger::LogLevel::trace)) { (log).trace(__VA_ARGS__); } } while (false)
+
 #endif // DV_LOGGER_H
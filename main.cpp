@@ -4,14 +4,43 @@
  * @copyright All rights reserved © 2020 David Vitez
  */
 
+#include <array>
+#include <atomic>
+#include <charconv>
 #include <iostream>
 #include <fstream>
+#include <string_view>
 #include <thread>
 #include <mutex>
 
 #include "logger.h"
 #include "logger_version.h"
 
+#if defined(__linux__)
+#include <pthread.h> // For pthread_setaffinity_np(). Used to pin stress test threads to cores.
+#endif
+
+/**
+ * @brief Logs the same message once at every logging level.
+ * @details basicTest repeats each of its messages at all six levels. Routing those blocks through one helper
+ * means each message's argument pack is instantiated once instead of six times over, which keeps the tester's
+ * generated code small without changing what gets logged. The call order matches the original hand-written
+ * blocks (alphabetical by level name).
+ * @param log
+ * — The logger instance to log with.
+ * @param msg
+ * — The message parts, exactly as they would be passed to any single logging call.
+ */
+template<typename... Message>
+void logAtAllLevels(DV::Logger& log, const Message&... msg) {
+    log.debug(msg...);
+    log.error(msg...);
+    log.fatal(msg...);
+    log.info (msg...);
+    log.trace(msg...);
+    log.warn (msg...);
+}
+
 /**
  * @brief The simplest logger test. Good for checking if the logger install is working.
  * @details This test logs a number of different messages at every logging level in order to test basic message
@@ -29,27 +58,14 @@
             LOGGER_VERSION_TWEAK
     );
 
-    log.debug("A single string literal argument to the function.");
-    log.error("A single string literal argument to the function.");
-    log.fatal("A single string literal argument to the function.");
-    log.info ("A single string literal argument to the function.");
-    log.trace("A single string literal argument to the function.");
-    log.warn ("A single string literal argument to the function.");
-
-    log.debug("Many", "string literals", "passed in", "all", "together.");
-    log.error("Many", "string literals", "passed in", "all", "together.");
-    log.fatal("Many", "string literals", "passed in", "all", "together.");
-    log.info ("Many", "string literals", "passed in", "all", "together.");
-    log.trace("Many", "string literals", "passed in", "all", "together.");
-    log.warn ("Many", "string literals", "passed in", "all", "together.");
-
-    std::string message = "Various types: ";
-    log.debug(message, 5, 3.14, 'a', "b c", &message);
-    log.error(message, 5, 3.14, 'a', "b c", &message);
-    log.fatal(message, 5, 3.14, 'a', "b c", &message);
-    log.info (message, 5, 3.14, 'a', "b c", &message);
-    log.trace(message, 5, 3.14, 'a', "b c", &message);
-    log.warn (message, 5, 3.14, 'a', "b c", &message);
+    logAtAllLevels(log, "A single string literal argument to the function.");
+
+    logAtAllLevels(log, "Many", "string literals", "passed in", "all", "together.");
+
+    // A string_view costs nothing to create — no heap allocation, not even a strlen at runtime — and the
+    // logger appends it through its length-aware path without ever copying it into an internal std::string.
+    constexpr std::string_view message = "Various types: ";
+    logAtAllLevels(log, message, 5, 3.14, 'a', "b c", &message);
     log.debug("Ending basic logging test.");
 }
 
@@ -73,11 +89,83 @@
         log.error(R"(Variable "start" must be < or == variable "end".)");
         return;
     }
-    log.debug("Beginning logging loop test.", "Looping", (end - start), "times from", start, "to", (end - 1), '.');
+    // The gating macros check the runtime level before the argument expressions here — like (end - start) —
+    // are evaluated, so when a level is filtered the loop pays one atomic load per call and nothing else.
+    DV_LOG_DEBUG(log, "Beginning logging loop test.", "Looping", (end - start), "times from", start, "to", (end - 1), '.');
+    // The hot loop hands the logger one preassembled string instead of separate parts. The buffer is
+    // thread_local and reused every iteration, so after the first call the loop allocates nothing: the
+    // int renders into a stack buffer via std::to_chars and is appended as plain characters.
+    thread_local std::string msgBuf;
+    msgBuf.reserve(64);
     for (int i = start; i < end; ++i) {
-        log.info("Loop iteration:", i);
+        msgBuf.assign("Loop iteration: ");
+        char digits[16];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), i);
+        msgBuf.append(digits, result.ptr);
+        DV_LOG_INFO(log, msgBuf);
     }
-    log.debug(start, "to", (end - 1), "loop ended.");
+    DV_LOG_DEBUG(log, start, "to", (end - 1), "loop ended.");
+}
+
+/**
+ * @brief logLoop for ranges known at compile time.
+ * @details threadTest always loops over literal ranges, so the start/end sanity check and the range arithmetic
+ * can be settled before the program runs: a static_assert replaces the runtime guard, and the loop bounds are
+ * constants the compiler can fold straight into the generated code. The runtime logLoop above stays for any
+ * caller whose range is computed.
+ * @tparam Start
+ * — The starting value to log (inclusive).
+ * @tparam End
+ * — The ending value which stops the logging loop (exclusive). Must be greater than Start.
+ * @param log
+ * — The logger instance to be used for testing.
+ */
+template<int Start, int End>
+[[maybe_unused]] void logLoopFixed(DV::Logger& log) {
+    static_assert(Start < End, R"(Template parameter "Start" must be < template parameter "End".)");
+    DV_LOG_DEBUG(log, "Beginning logging loop test.", "Looping", (End - Start), "times from", Start, "to", (End - 1), '.');
+    thread_local std::string msgBuf;
+    msgBuf.reserve(64);
+    for (int i = Start; i < End; ++i) {
+        msgBuf.assign("Loop iteration: ");
+        char digits[16];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), i);
+        msgBuf.append(digits, result.ptr);
+        DV_LOG_INFO(log, msgBuf);
+    }
+    DV_LOG_DEBUG(log, Start, "to", (End - 1), "loop ended.");
+}
+
+/**
+ * @brief Pins a thread to one processor core (on Linux; a no-op elsewhere).
+ * @details Left to itself the scheduler migrates busy threads between cores, and every migration drags the
+ * thread's cache state along with it — which makes contention-heavy timings wander from run to run. Pinning
+ * each stress test worker to its own core keeps the contention pattern stable and repeatable.
+ * @param worker
+ * — The thread to pin.
+ * @param core
+ * — Which core to pin it to. Wrapped into range, so passing a plain worker index is fine on any machine.
+ */
+[[maybe_unused]] void pinToCore([[maybe_unused]] std::thread& worker, [[maybe_unused]] unsigned core) {
+#if defined(__linux__)
+    const unsigned coreCount = std::thread::hardware_concurrency();
+    if (coreCount == 0) { return; } // Unknown topology. Let the scheduler do as it pleases.
+    cpu_set_t cores;
+    CPU_ZERO(&cores);
+    CPU_SET(core % coreCount, &cores);
+    pthread_setaffinity_np(worker.native_handle(), sizeof(cores), &cores);
+#endif
+}
+
+/**
+ * @brief The calling thread's id as a plain integer.
+ * @details Streaming std::this_thread::get_id() goes through the id type's opaque operator<<, which on common
+ * standard libraries locks a global stream state and may allocate. Hashing the id down to a number instead
+ * lets the logger render it through its allocation-free std::to_chars path. The values differ from what
+ * operator<< would print, but all the tests need is a stable, distinct number per thread.
+ */
+[[maybe_unused]] uint64_t tid() {
+    return static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
 }
 
 /**
@@ -89,36 +177,51 @@
  * — The logger instance to run the test with.
  */
 [[maybe_unused]] void threadTest(DV::Logger& log) {
-    log.debug("Thread ID:", std::this_thread::get_id());
+    log.debug("Thread ID:", tid());
     log.debug("Spawning 5 other threads.");
-    std::thread loop1(logLoop, std::ref(log), 0, 1000);
-    log.debug("Started Thread ID:", std::this_thread::get_id(), "--", loop1.get_id());
-    std::thread loop2(logLoop, std::ref(log), 1000, 2000);
-    log.debug("Started Thread ID:", std::this_thread::get_id(), "--", loop2.get_id());
-    std::thread loop3(logLoop, std::ref(log), 2000, 3000);
-    log.debug("Started Thread ID:", std::this_thread::get_id(), "--", loop3.get_id());
-    std::thread loop4(logLoop, std::ref(log), 3000, 4000);
-    log.debug("Started Thread ID:", std::this_thread::get_id(), "--", loop4.get_id());
-    std::thread loop5(logLoop, std::ref(log), 4000, 5000);
-    log.debug("Started Thread ID:", std::this_thread::get_id(), "--", loop5.get_id());
 
-    // Make sure the threads all spawned correctly and wait for them to finish before returning.
-    if (loop1.joinable() &&
-            loop2.joinable() &&
-            loop3.joinable() &&
-            loop4.joinable() &&
-            loop5.joinable()) {
-        loop1.join();
-        loop2.join();
-        loop3.join();
-        loop4.join();
-        loop5.join();
+    // The workers wait on a start gate and are released together rather than running the moment each is
+    // constructed. Without the gate the first thread has logged hundreds of entries before the last one even
+    // exists, so the test would mostly stress one lonely producer instead of five contending ones.
+    std::atomic<bool> startGate(false);
+    auto waitForStart = [&startGate] {
+        while (!startGate.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+    };
+    std::array<std::thread, 5> loops = {
+            std::thread([&] { waitForStart(); logLoopFixed<0, 1000>(log); }),
+            std::thread([&] { waitForStart(); logLoopFixed<1000, 2000>(log); }),
+            std::thread([&] { waitForStart(); logLoopFixed<2000, 3000>(log); }),
+            std::thread([&] { waitForStart(); logLoopFixed<3000, 4000>(log); }),
+            std::thread([&] { waitForStart(); logLoopFixed<4000, 5000>(log); }),
+    };
+    // Pin each worker to its own core so scheduler migrations don't reshuffle the contention pattern
+    // mid-test. Core 0 is left for the main thread and the logger's writer thread.
+    for (size_t k = 0; k < loops.size(); ++k) {
+        pinToCore(loops[k], static_cast<unsigned>(k) + 1);
     }
-    else {
-        log.error("Could not join the 5 sub-threads!");
+
+    // One announcement for all five spawns instead of five back-to-back debug calls — the pre-stress phase
+    // should put as little of its own traffic in front of the workers as possible.
+    std::array<uint64_t, 5> childIds = {};
+    for (size_t k = 0; k < loops.size(); ++k) {
+        childIds[k] = static_cast<uint64_t>(std::hash<std::thread::id>{}(loops[k].get_id()));
+    }
+    log.debug("Started 5 threads. Main:", tid(),
+            "-- children:", childIds[0], childIds[1], childIds[2], childIds[3], childIds[4]);
+    startGate.store(true, std::memory_order_release);
+
+    // Make sure the threads all spawned correctly and wait for them to finish before returning.
+    for (std::thread& loop : loops) {
+        if (loop.joinable()) { loop.join(); }
+        else { log.error("Could not join one of the 5 sub-threads!"); }
     }
 }
 
+// The two error-path tests below deliberately break streams out from under a logger — one is expected to
+// segfault. They are only compiled when asked for (see DV_LOGGER_ENABLE_ERROR_TESTS in CMakeLists.txt), so
+// ordinary tester builds don't carry code whose call sites stay commented out.
+#if defined(DV_LOGGER_ENABLE_ERROR_TESTS)
+
 /**
  * @brief Deliberately closes a file stream being used by the logger to see what happens.
  * @details Writing to a closed file stream is an extremely easy way to put a stream into a bad state. This doesn't
@@ -186,11 +289,19 @@
     log.trace("Exiting deadStreamTest().");
 }
 
+#endif // DV_LOGGER_ENABLE_ERROR_TESTS
+
 /**
  * @brief Test adding extra streams to a logger.
  * @details This test tries to tee a logger multiple times, creating log entries before and after each split.
  */
 [[maybe_unused]] void teeStreamTest() {
+    // The file streams are declared before the logger so they outlive it: the logger's destructor drains any
+    // still-queued entries into its streams — on every exit path, including the early returns below — which
+    // only works if the streams still exist at that point. They open lazily as the test progresses.
+    std::ofstream fileA;
+    std::ofstream fileB;
+    std::ofstream fileC;
     DV::Logger log("Multilog", std::cout);
 
     log.debug("Logger created.");
@@ -199,7 +310,7 @@
     log.warn("Printing in color. Watch for colors.");
 
     log.debug("Adding a split/tee to a file.");
-    std::ofstream fileA("split-stream-a.log");
+    fileA.open("split-stream-a.log");
     if (!fileA.is_open()) {
         log.error("Could not open file!!!");
         log.error("Aborting test.");
@@ -211,7 +322,7 @@
     log.info("Testing split (tee'd) output!");
 
     log.debug("Adding a split/tee to a file.");
-    std::ofstream fileB("split-stream-b.log");
+    fileB.open("split-stream-b.log");
     if (!fileB.is_open()) {
         log.error("Could not open file!!!");
         log.error("Aborting test.");
@@ -223,7 +334,7 @@
     log.info("Testing output with 2 splits!");
 
     log.debug("Adding a split/tee to a file.");
-    std::ofstream fileC("split-stream-c.log");
+    fileC.open("split-stream-c.log");
     if (!fileC.is_open()) {
         log.error("Could not open file!!!");
         log.error("Aborting test.");
@@ -254,6 +365,11 @@
  */
 int main() {
 
+    // Unhook C++ streams from C stdio. By default every write through std::cout is funneled into stdout's C
+    // buffer so printf and cout can interleave safely — a per-call tax this tester never benefits from, since
+    // nothing here uses stdio. Untangling them lets cout buffer and flush on its own terms.
+    std::ios::sync_with_stdio(false);
+
     // Log to the standard character output stream.
     // DV::Logger termLog("User Terminal", std::cout);
     // basicTest(termLog);
@@ -268,20 +384,33 @@ int main() {
     // threadTest(fileLog);
 
     // Test the logger when the stream it's using is in a bad state.
+    // (These are only compiled when DV_LOGGER_ENABLE_ERROR_TESTS is turned on in CMake.)
     // badStreamTest(termLog);  // Stream becomes unusable.
     // deadStreamTest(termLog); // Deliberately causes a seg-fault.
 
     // Test adding additional output stream references to the logger.
     // teeStreamTest();
 
+    // The file streams are declared before the logger so they outlive it: the logger's destructor drains any
+    // still-queued entries into its streams, which only works if the streams are still open at that point.
+    // Each gets a 64 KB buffer — matching the logger's internal batch size — instead of the default few KB, so
+    // a batched write from the logger reaches the kernel in one write() call rather than a dozen. The buffers
+    // must be installed before open() for pubsetbuf() to take effect.
+    static char fileBufferA[64 * 1024];
+    static char fileBufferB[64 * 1024];
+    static char fileBufferC[64 * 1024];
+    std::ofstream fileA;
+    std::ofstream fileB;
+    std::ofstream fileC;
+    fileA.rdbuf()->pubsetbuf(fileBufferA, sizeof(fileBufferA));
+    fileB.rdbuf()->pubsetbuf(fileBufferB, sizeof(fileBufferB));
+    fileC.rdbuf()->pubsetbuf(fileBufferC, sizeof(fileBufferC));
+    fileA.open("output-a.log");
+    fileB.open("output-b.log");
+    fileC.open("output-c.log");
     DV::Logger multilog("Multi-Log", std::cout);
-    std::ofstream fileA("output-a.log");
-    std::ofstream fileB("output-b.log");
-    std::ofstream fileC("output-c.log");
 
-    multilog.addSplit(fileA);
-    multilog.addSplit(fileB);
-    multilog.addSplit(fileC);
+    multilog.addSplits({ fileA, fileB, fileC });
 
     threadTest(multilog);
 